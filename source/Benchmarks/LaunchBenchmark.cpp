@@ -0,0 +1,85 @@
+#include <windows.h>
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include "TimerArgs.h"
+#include "CommandLauncher.h"
+
+
+//================================================================================================//
+// Launch Benchmark
+//================================================================================================//
+
+// A command line with arguments: ShellExecute cannot open it, so every uncached launch
+// pays for the failed ShellExecute attempt before falling back to CreateProcess.
+constexpr const wchar_t* DEFAULT_COMMAND = L"cmd.exe /c exit 0";
+constexpr int DEFAULT_LAUNCHES = 50;
+
+/**
+ * @brief Launches cmd the given number of times and returns the average time per launch in microseconds.
+ * With useCache false the launch spec cache is cleared before every launch.
+ */
+double MeasureLaunches(const std::wstring& cmd, int launches, bool useCache)
+{
+    ClearLaunchSpecCache();
+    if (useCache)
+    {
+        // Warm up so that every measured launch hits the cache
+        LaunchCommand(cmd);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < launches; ++i)
+    {
+        if (!useCache) ClearLaunchSpecCache();
+
+        if (unsigned long err = LaunchCommand(cmd); err != 0)
+        {
+            std::fwprintf(stderr, L"Failed to execute command (Error code: %lu)\n", err);
+            return -1.0;
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::micro>(elapsed).count() / launches;
+}
+
+/**
+ * @brief Usage: LaunchBenchmark [launches] [command...]
+ */
+int wmain(int argc, wchar_t* argv[])
+{
+    int launches = DEFAULT_LAUNCHES;
+    std::wstring cmd = DEFAULT_COMMAND;
+
+    if (argc > 1)
+    {
+        auto value = ValidateAndParsePositiveInt(std::wstring_view(argv[1]));
+        if (!value.has_value() || value.value() == 0)
+        {
+            std::fwprintf(stderr, L"Usage: LaunchBenchmark [launches] [command...]\n");
+            return 2;
+        }
+        launches = value.value();
+    }
+    if (argc > 2)
+    {
+        cmd = argv[2];
+        for (int i = 3; i < argc; ++i)
+        {
+            cmd += L" ";
+            cmd += argv[i];
+        }
+    }
+
+    double uncached = MeasureLaunches(cmd, launches, false);
+    double cached = MeasureLaunches(cmd, launches, true);
+    if (uncached < 0.0 || cached < 0.0) return 1;
+
+    std::wprintf(L"Command:  %ls\n", cmd.c_str());
+    std::wprintf(L"Launches: %d\n", launches);
+    std::wprintf(L"Uncached: %.1f us/launch\n", uncached);
+    std::wprintf(L"Cached:   %.1f us/launch\n", cached);
+    std::wprintf(L"Saving:   %.1f us/launch\n", uncached - cached);
+    return 0;
+}
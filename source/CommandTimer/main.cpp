@@ -7,21 +7,17 @@
 #include <algorithm>
 #include <string_view>
 #include <optional>
-#include <limits>
+
+#include "CountdownTimer.h"
+#include "TimerArgs.h"
+#include "CommandHistory.h"
+#include "CommandLauncher.h"
 
 
 //================================================================================================//
 // Global Variables and Constants
 //================================================================================================//
 
-// --- Application State ---
-enum class TimerState
-{
-    STOPPED,
-    RUNNING,
-    PAUSED
-};
-
 // --- Control IDs ---
 constexpr int IDC_EDIT_HOUR = 101;
 constexpr int IDC_EDIT_MIN = 102;
@@ -35,23 +31,15 @@ constexpr int IDC_BTN_HOMEPAGE = 109;
 constexpr int IDC_BTN_PRESET1 = 110;
 constexpr int IDC_BTN_PRESET2 = 111;
 constexpr int IDC_BTN_PRESET3 = 112;
-constexpr int MAX_HISTORY = 20;
 
 // --- CommandLine Options ---
-struct CommandLineOptions {
-    bool startImmediately = false;
-    int hours = 0;
-    int minutes = 0;
-    int seconds = 0;
-    std::wstring command = std::wstring();
-};
+using CommandLineOptions = BasicCommandLineOptions<wchar_t>;
 
 // --- Global Handles and Variables ---
 HINSTANCE g_hInst;
 HWND      g_hWnd;
 UINT_PTR  g_timerId = 0;
-int       g_remainingSeconds = 0;
-TimerState g_timerState = TimerState::STOPPED;
+CountdownTimer g_countdown;
 HFONT     g_hDefaultFont = NULL;
 HFONT     g_hTimerFont = NULL;
 wchar_t   g_iniFilePath[MAX_PATH];
@@ -90,9 +78,6 @@ void LoadPresetTimes();
 void LoadCommandHistory(HWND hWnd);
 void SaveCommandHistory(HWND hWnd);
 
-// --- Utility ---
-std::optional<int> ValidateAndParsePositiveInt(std::wstring_view s);
-
 
 //================================================================================================//
 // Core Win32 Functions
@@ -139,8 +124,8 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR pCmdLine
 
         startImmediately = cmdOptions.startImmediately;
 
-        g_remainingSeconds = (cmdOptions.hours * 3600) + (cmdOptions.minutes * 60) + cmdOptions.seconds;
-        if (g_remainingSeconds > 0) {
+        g_countdown.SetDuration(cmdOptions.hours, cmdOptions.minutes, cmdOptions.seconds);
+        if (g_countdown.GetRemainingSeconds() > 0) {
             SetDlgItemInt(g_hWnd, IDC_EDIT_HOUR, cmdOptions.hours, FALSE);
             SetDlgItemInt(g_hWnd, IDC_EDIT_MIN, cmdOptions.minutes, FALSE);
             SetDlgItemInt(g_hWnd, IDC_EDIT_SEC, cmdOptions.seconds, FALSE);
@@ -164,7 +149,7 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR pCmdLine
     ShowWindow(g_hWnd, nCmdShow);
     UpdateWindow(g_hWnd);
 
-    if (startImmediately && g_remainingSeconds > 0)
+    if (startImmediately && g_countdown.GetRemainingSeconds() > 0)
     {
         PostMessage(g_hWnd, WM_COMMAND, MAKEWPARAM(IDC_BTN_START, BN_CLICKED), 0);
     }
@@ -207,17 +192,13 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
     }
     case WM_TIMER:
     {
-        if (g_remainingSeconds > 0)
-        {
-            g_remainingSeconds--;
-            UpdateTimerDisplay(hWnd);
-        }
+        bool expired = g_countdown.Tick();
+        UpdateTimerDisplay(hWnd);
 
-        if (g_remainingSeconds <= 0)
+        if (expired)
         {
             KillTimer(hWnd, g_timerId);
             g_timerId = 0;
-            g_timerState = TimerState::STOPPED;
             ExecuteTimerCommand(hWnd);
             UpdateControlStatesByTimerStatus(hWnd);
         }
@@ -247,61 +228,13 @@ std::optional<CommandLineOptions> ParseCommandLineArgs() {
     int argc;
     LPWSTR* argv = CommandLineToArgvW(GetCommandLineW(), &argc);
 
-    if (argv == NULL || argc < 2) {
-        if (argv) LocalFree(argv);
+    if (argv == NULL) {
         return CommandLineOptions{};
     }
 
-    CommandLineOptions options;
-    bool success = true;
-
-    for (int i = 1; i < argc; ++i) {
-        std::wstring_view arg = argv[i];
-
-        if (arg == L"-start") {
-            options.startImmediately = true;
-        }
-        else if (arg == L"-h" || arg == L"-m" || arg == L"-s") {
-            if (i + 1 >= argc) {
-                success = false;
-                break;
-            }
-
-            auto value = ValidateAndParsePositiveInt(argv[++i]);
-            if (!value.has_value()) {
-                success = false;
-                break;
-            }
-
-            if (arg == L"-h") options.hours = value.value();
-            else if (arg == L"-m") options.minutes = value.value();
-            else if (arg == L"-s") options.seconds = value.value();
-        }
-        else if (arg == L"-cmd") {
-            if (i + 1 >= argc) {
-                success = false;
-                break;
-            }
-
-            options.command = argv[++i];
-            while (i + 1 < argc && argv[i + 1][0] != L'-') {
-                options.command += L" ";
-                options.command += argv[++i];
-            }
-        }
-        else {
-            success = false;
-            break;
-        }
-    }
-
+    auto options = ParseTimerArgs<wchar_t>(argc, argv);
     LocalFree(argv);
-
-    if (success) {
-        return options;
-    }
-
-    return std::nullopt;
+    return options;
 }
 
 //================================================================================================//
@@ -367,9 +300,10 @@ void CreateMainWindowControls(HWND hWnd)
  */
 void UpdateTimerDisplay(HWND hWnd)
 {
-    int h = g_remainingSeconds / 3600;
-    int m = (g_remainingSeconds % 3600) / 60;
-    int s = g_remainingSeconds % 60;
+    int remainingSeconds = g_countdown.GetRemainingSeconds();
+    int h = remainingSeconds / 3600;
+    int m = (remainingSeconds % 3600) / 60;
+    int s = remainingSeconds % 60;
     std::wstring timeString = std::format(L"{:02}:{:02}:{:02}", h, m, s);
     SetDlgItemText(hWnd, IDC_STATIC_TIMER_DISPLAY, timeString.c_str());
 }
@@ -379,9 +313,9 @@ void UpdateTimerDisplay(HWND hWnd)
  */
 void UpdateControlStatesByTimerStatus(HWND hWnd)
 {
-    bool isStopped = (g_timerState == TimerState::STOPPED);
-    bool isRunning = (g_timerState == TimerState::RUNNING);
-    bool isPaused = (g_timerState == TimerState::PAUSED);
+    bool isStopped = (g_countdown.GetState() == TimerState::STOPPED);
+    bool isRunning = (g_countdown.GetState() == TimerState::RUNNING);
+    bool isPaused = (g_countdown.GetState() == TimerState::PAUSED);
 
     // Enable time and command inputs only when stopped
     EnableWindow(GetDlgItem(hWnd, IDC_EDIT_HOUR), isStopped);
@@ -413,30 +347,29 @@ void UpdateControlStatesByTimerStatus(HWND hWnd)
  */
 void OnStartButtonClick(HWND hWnd)
 {
-    if (g_timerState == TimerState::STOPPED)
+    if (g_countdown.GetState() == TimerState::STOPPED)
     {
         wchar_t hourStr[10], minStr[10], secStr[10];
         GetDlgItemText(hWnd, IDC_EDIT_HOUR, hourStr, 10);
         GetDlgItemText(hWnd, IDC_EDIT_MIN, minStr, 10);
         GetDlgItemText(hWnd, IDC_EDIT_SEC, secStr, 10);
 
-        auto v = ValidateAndParsePositiveInt(hourStr);
+        auto v = ValidateAndParsePositiveInt(std::wstring_view(hourStr));
         int hours = (v.has_value()) ? v.value() : 0;
-        v = ValidateAndParsePositiveInt(minStr);
+        v = ValidateAndParsePositiveInt(std::wstring_view(minStr));
         int minutes = (v.has_value()) ? v.value() : 0;
-        v = ValidateAndParsePositiveInt(secStr);
+        v = ValidateAndParsePositiveInt(std::wstring_view(secStr));
         int seconds = (v.has_value()) ? v.value() : 0;
 
-        g_remainingSeconds = (hours * 3600) + (minutes * 60) + seconds;
+        g_countdown.SetDuration(hours, minutes, seconds);
     }
 
-    if (g_remainingSeconds > 0)
+    if (g_countdown.Start())
     {
         g_timerId = SetTimer(hWnd, 1, 1000, NULL);
-        g_timerState = TimerState::RUNNING;
         SaveCommandHistory(hWnd);
     }
-    else if (g_timerState == TimerState::STOPPED)
+    else if (g_countdown.GetState() == TimerState::STOPPED)
     {
         MessageBox(hWnd, L"Please enter a time greater than 0 seconds.", L"Input Error", MB_OK | MB_ICONWARNING);
     }
@@ -449,11 +382,10 @@ void OnStartButtonClick(HWND hWnd)
  */
 void OnPauseButtonClick(HWND hWnd)
 {
-    if (g_timerState == TimerState::RUNNING)
+    if (g_countdown.Pause())
     {
         KillTimer(hWnd, g_timerId);
         g_timerId = 0;
-        g_timerState = TimerState::PAUSED;
         UpdateControlStatesByTimerStatus(hWnd);
     }
 }
@@ -468,8 +400,7 @@ void OnResetButtonClick(HWND hWnd)
         KillTimer(hWnd, g_timerId);
         g_timerId = 0;
     }
-    g_remainingSeconds = 0;
-    g_timerState = TimerState::STOPPED;
+    g_countdown.Reset();
     UpdateTimerDisplay(hWnd);
     UpdateControlStatesByTimerStatus(hWnd);
 }
@@ -487,16 +418,17 @@ void OnHomepageButtonClick(HWND hWnd)
  */
 void OnPresetButtonClick(HWND hWnd, int presetMinutes)
 {
-    if (g_timerState != TimerState::STOPPED) return;
+    if (g_countdown.GetState() != TimerState::STOPPED) return;
 
-    g_remainingSeconds = presetMinutes * 60;
+    g_countdown.SetDuration(0, presetMinutes, 0);
 
-    if (g_remainingSeconds > 0)
+    if (g_countdown.Start())
     {
         // Update the edit controls to reflect the preset time
-        int h = g_remainingSeconds / 3600;
-        int m = (g_remainingSeconds % 3600) / 60;
-        int s = g_remainingSeconds % 60;
+        int remainingSeconds = g_countdown.GetRemainingSeconds();
+        int h = remainingSeconds / 3600;
+        int m = (remainingSeconds % 3600) / 60;
+        int s = remainingSeconds % 60;
         SetDlgItemInt(hWnd, IDC_EDIT_HOUR, h, FALSE);
         SetDlgItemInt(hWnd, IDC_EDIT_MIN, m, FALSE);
         SetDlgItemInt(hWnd, IDC_EDIT_SEC, s, FALSE);
@@ -504,7 +436,6 @@ void OnPresetButtonClick(HWND hWnd, int presetMinutes)
 
         // Start the timer
         g_timerId = SetTimer(hWnd, 1, 1000, NULL);
-        g_timerState = TimerState::RUNNING;
         SaveCommandHistory(hWnd);
         UpdateControlStatesByTimerStatus(hWnd);
     }
@@ -526,24 +457,10 @@ void ExecuteTimerCommand(HWND hWnd)
 
     SaveCommandHistory(hWnd); // Ensure the executed command is saved
 
-    // Try executing with ShellExecute first
-    HINSTANCE hInst = ShellExecute(hWnd, L"open", cmd, NULL, NULL, SW_SHOWNORMAL);
-    if ((INT_PTR)hInst <= 32)
+    if (unsigned long err = LaunchCommand(cmd, hWnd); err != 0)
     {
-        // If ShellExecute fails, fallback to CreateProcess
-        STARTUPINFOW si{ sizeof(si) };
-        PROCESS_INFORMATION pi{};
-        std::vector<wchar_t> line(cmd, cmd + wcslen(cmd) + 1);
-
-        if (!CreateProcessW(NULL, line.data(), NULL, NULL, FALSE, 0, NULL, NULL, &si, &pi))
-        {
-            DWORD err = GetLastError();
-            std::wstring errorMsg = std::format(L"Failed to execute command (Error code: {})", err);
-            MessageBoxW(hWnd, errorMsg.c_str(), L"Execution Error", MB_OK | MB_ICONERROR);
-            return;
-        }
-        CloseHandle(pi.hProcess);
-        CloseHandle(pi.hThread);
+        std::wstring errorMsg = std::format(L"Failed to execute command (Error code: {})", err);
+        MessageBoxW(hWnd, errorMsg.c_str(), L"Execution Error", MB_OK | MB_ICONERROR);
     }
 }
 
@@ -627,36 +544,25 @@ void SaveCommandHistory(HWND hWnd)
     const wchar_t* section = L"CommandHistory";
     HWND hCombo = GetDlgItem(hWnd, IDC_COMBO_CMD);
 
-    std::vector<std::wstring> history;
     wchar_t currentCmd[512];
     GetDlgItemTextW(hWnd, IDC_COMBO_CMD, currentCmd, 512);
 
-    // 1. Add the current command to the top of the history if it's not empty.
-    if (wcslen(currentCmd) > 0)
-    {
-        history.push_back(currentCmd);
-    }
-
-    // 2. Read existing commands from the INI file.
+    // 1. Read existing commands from the INI file.
+    std::vector<std::wstring> savedHistory;
     int oldCount = GetPrivateProfileIntW(section, L"Count", 0, g_iniFilePath);
     for (int i = 1; i <= oldCount; ++i)
     {
-        if (history.size() >= MAX_HISTORY) break;
-
         wchar_t key[20];
         swprintf_s(key, L"Command%d", i);
         wchar_t oldCmd[512];
         GetPrivateProfileStringW(section, key, L"", oldCmd, 512, g_iniFilePath);
-
-        // 3. Add old command only if it's not already in our new history list.
-        if (wcslen(oldCmd) > 0 &&
-            std::find(history.begin(), history.end(), oldCmd) == history.end())
-        {
-            history.push_back(oldCmd);
-        }
+        savedHistory.push_back(oldCmd);
     }
 
-    // 4. Clear the old section and write the new, cleaned history to the INI file.
+    // 2. Put the current command on top, dropping duplicates and trimming to MAX_HISTORY.
+    std::vector<std::wstring> history = MergeCommandHistory(std::wstring_view(currentCmd), savedHistory);
+
+    // 3. Clear the old section and write the new, cleaned history to the INI file.
     WritePrivateProfileStringW(section, NULL, NULL, g_iniFilePath);
     WritePrivateProfileStringW(section, L"Count", std::to_wstring(history.size()).c_str(), g_iniFilePath);
 
@@ -667,7 +573,7 @@ void SaveCommandHistory(HWND hWnd)
         WritePrivateProfileStringW(section, key, history[i].c_str(), g_iniFilePath);
     }
 
-    // 5. Update the ComboBox UI to match the newly saved history.
+    // 4. Update the ComboBox UI to match the newly saved history.
     SendMessage(hCombo, CB_RESETCONTENT, 0, 0);
     for (const auto& cmd : history)
     {
@@ -676,23 +582,4 @@ void SaveCommandHistory(HWND hWnd)
 
     // Restore the text that the user might have been editing.
     SetDlgItemTextW(hWnd, IDC_COMBO_CMD, currentCmd);
-}
-
-//================================================================================================//
-// Utility
-//================================================================================================//
-
-std::optional<int> ValidateAndParsePositiveInt(std::wstring_view s) {
-    if (s.empty()) return std::nullopt;
-
-    int value = 0;
-    constexpr int INT_MAX_VAL = (std::numeric_limits<int>::max)();
-
-    for (wchar_t ch : s) {
-        if (ch < L'0' || ch > L'9') return std::nullopt;
-        int digit = ch - L'0';
-        if (value > (INT_MAX_VAL - digit) / 10) return std::nullopt;
-        value = value * 10 + digit;
-    }
-    return value;
 }
\ No newline at end of file
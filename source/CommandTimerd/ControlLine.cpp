@@ -0,0 +1,98 @@
+#include "ControlLine.h"
+
+#include <optional>
+
+
+/**
+ * @brief Splits a control line on whitespace. Double quotes group words and are removed,
+ * so -cmd "echo hello" passes echo hello to the shell. A trailing CR from CRLF input is ignored.
+ */
+std::vector<std::string> SplitControlLine(std::string_view line)
+{
+    std::vector<std::string> tokens;
+    std::string current;
+    bool inQuotes = false;
+    bool hasToken = false;
+
+    for (char ch : line)
+    {
+        if (ch == '"')
+        {
+            inQuotes = !inQuotes;
+            hasToken = true;
+        }
+        else if (!inQuotes && (ch == ' ' || ch == '\t' || ch == '\r'))
+        {
+            if (hasToken) tokens.push_back(current);
+            current.clear();
+            hasToken = false;
+        }
+        else
+        {
+            current += ch;
+            hasToken = true;
+        }
+    }
+    if (hasToken) tokens.push_back(current);
+
+    return tokens;
+}
+
+/**
+ * @brief Parses one control line. Lines starting with '-' add a timer using the same arguments
+ * as the command line; otherwise the line is one of: start|pause|reset|remove <id>, list, quit.
+ */
+ControlCommand ParseControlLine(std::string_view line)
+{
+    ControlCommand command;
+    std::vector<std::string> tokens = SplitControlLine(line);
+    if (tokens.empty()) return command;
+
+    if (tokens[0][0] == '-')
+    {
+        std::vector<const char*> args;
+        args.push_back("commandtimerd");
+        for (const auto& token : tokens)
+        {
+            args.push_back(token.c_str());
+        }
+
+        if (auto options = ParseTimerArgs<char>(static_cast<int>(args.size()), args.data()); options.has_value())
+        {
+            command.verb = ControlVerb::ADD_TIMER;
+            command.options = options.value();
+        }
+        else
+        {
+            command.verb = ControlVerb::INVALID_ARGS;
+        }
+        return command;
+    }
+
+    const std::string& verb = tokens[0];
+    if (verb == "list")
+    {
+        command.verb = ControlVerb::LIST;
+        return command;
+    }
+    if (verb == "quit")
+    {
+        command.verb = ControlVerb::QUIT;
+        return command;
+    }
+
+    command.verb = ControlVerb::UNKNOWN;
+
+    std::optional<int> id;
+    if (tokens.size() == 2) id = ValidateAndParsePositiveInt(std::string_view(tokens[1]));
+    if (!id.has_value()) return command;
+
+    if (verb == "start")       command.verb = ControlVerb::START;
+    else if (verb == "pause")  command.verb = ControlVerb::PAUSE;
+    else if (verb == "reset")  command.verb = ControlVerb::RESET;
+    else if (verb == "remove") command.verb = ControlVerb::REMOVE;
+    else return command;
+
+    command.timerId = id.value();
+    return command;
+}
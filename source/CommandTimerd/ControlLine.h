@@ -0,0 +1,37 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "TimerArgs.h"
+
+
+//================================================================================================//
+// Control Lines
+//================================================================================================//
+
+// --- Control Verbs ---
+enum class ControlVerb
+{
+    NONE,           // blank line
+    ADD_TIMER,      // -start -h -m -s -cmd, same as the command line
+    INVALID_ARGS,   // a '-' line that ParseTimerArgs rejected
+    START,
+    PAUSE,
+    RESET,
+    REMOVE,
+    LIST,
+    QUIT,
+    UNKNOWN
+};
+
+// --- Parsed Control Line ---
+struct ControlCommand {
+    ControlVerb verb = ControlVerb::NONE;
+    int timerId = 0;                            // START, PAUSE, RESET and REMOVE only
+    BasicCommandLineOptions<char> options;      // ADD_TIMER only
+};
+
+std::vector<std::string> SplitControlLine(std::string_view line);
+ControlCommand ParseControlLine(std::string_view line);
@@ -0,0 +1,537 @@
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <sys/signalfd.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <signal.h>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include <map>
+#include <string>
+#include <string_view>
+
+#include "CountdownTimer.h"
+#include "TimerArgs.h"
+#include "CommandLauncher.h"
+#include "ControlLine.h"
+
+
+//================================================================================================//
+// Global Variables and Constants
+//================================================================================================//
+
+// --- CommandLine Options ---
+using CommandLineOptions = BasicCommandLineOptions<char>;
+
+// --- Hosted Timer ---
+struct DaemonTimer {
+    CommandLineOptions options;   // duration and command as given on the command line
+    CountdownTimer countdown;
+    int timerFd = -1;             // one-shot timerfd for the remaining time, open only while running
+    std::chrono::steady_clock::time_point startedAt;  // when the current run was armed
+};
+
+// --- epoll Event Tags (timers use their id) ---
+constexpr uint64_t CONTROL_EVENT = UINT64_MAX;
+constexpr uint64_t SIGNAL_EVENT = UINT64_MAX - 1;
+constexpr int MAX_EVENTS = 64;
+
+// --- Global Handles and Variables ---
+int         g_epollFd = -1;
+int         g_signalFd = -1;
+int         g_nextTimerId = 1;
+int         g_runningTimers = 0;    // number of open timerfds, i.e. running timers
+bool        g_controlOpen = false;
+bool        g_controlIsFile = false;
+bool        g_quit = false;
+std::string g_controlBuffer;
+std::map<int, DaemonTimer> g_timers;
+
+
+//================================================================================================//
+// Function Prototypes
+//================================================================================================//
+
+// --- Event Loop ---
+bool SetupEventLoop();
+void RunEventLoop();
+
+// --- Event Handlers ---
+void OnTimerEvent(int id);
+void OnSignalEvent();
+void OnControlInput();
+
+// --- Timer Management ---
+int AddTimer(const CommandLineOptions& options);
+int GetRemainingSeconds(const DaemonTimer& timer);
+void StartTimer(int id, DaemonTimer& timer);
+void PauseTimer(int id, DaemonTimer& timer);
+void ResetTimer(int id, DaemonTimer& timer);
+void FinishTimer(int id, DaemonTimer& timer);
+void DisarmTimer(DaemonTimer& timer);
+void ExecuteTimerCommand(int id, const DaemonTimer& timer);
+void ListTimers();
+
+// --- Control Input ---
+void HandleControlLine(std::string_view line);
+
+// --- Utility ---
+void PrintTimer(int id, const DaemonTimer& timer, const char* event);
+void PrintUsage();
+
+
+//================================================================================================//
+// Entry Point and Event Loop
+//================================================================================================//
+
+/**
+ * @brief Headless counterpart of the Win32 front end. The process arguments describe the first
+ * timer; further timers and control commands are read line by line from standard input.
+ */
+int main(int argc, char* argv[])
+{
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    auto cmdOptions = ParseTimerArgs<char>(argc, argv);
+    if (!cmdOptions.has_value())
+    {
+        PrintUsage();
+        return 2;
+    }
+
+    if (!SetupEventLoop())
+    {
+        return 1;
+    }
+
+    // Without arguments there is nothing to host yet; wait for timers on standard input.
+    if (argc > 1)
+    {
+        AddTimer(cmdOptions.value());
+    }
+
+    // Regular files cannot be polled; they are always readable, so consume them up front,
+    // after the command-line timer so that it is always timer [1].
+    while (g_controlIsFile && g_controlOpen && !g_quit)
+    {
+        OnControlInput();
+    }
+
+    RunEventLoop();
+
+    for (auto& [id, timer] : g_timers)
+    {
+        DisarmTimer(timer);
+    }
+    close(g_signalFd);
+    close(g_epollFd);
+    return 0;
+}
+
+/**
+ * @brief Creates the epoll instance and registers the signal and control descriptors.
+ */
+bool SetupEventLoop()
+{
+    g_epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (g_epollFd < 0)
+    {
+        std::perror("epoll_create1");
+        return false;
+    }
+
+    // Signals are delivered through a signalfd so that the loop never runs in a handler.
+    sigset_t mask;
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGCHLD);
+    sigaddset(&mask, SIGINT);
+    sigaddset(&mask, SIGTERM);
+    sigprocmask(SIG_BLOCK, &mask, NULL);
+
+    g_signalFd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+    if (g_signalFd < 0)
+    {
+        std::perror("signalfd");
+        return false;
+    }
+
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.u64 = SIGNAL_EVENT;
+    if (epoll_ctl(g_epollFd, EPOLL_CTL_ADD, g_signalFd, &ev) < 0)
+    {
+        std::perror("epoll_ctl");
+        return false;
+    }
+
+    ev.data.u64 = CONTROL_EVENT;
+    if (epoll_ctl(g_epollFd, EPOLL_CTL_ADD, STDIN_FILENO, &ev) == 0)
+    {
+        g_controlOpen = true;
+    }
+    else if (errno == EPERM)
+    {
+        g_controlOpen = true;
+        g_controlIsFile = true;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Dispatches events until asked to quit, or until control input is closed and no
+ * timer is left running.
+ */
+void RunEventLoop()
+{
+    epoll_event events[MAX_EVENTS];
+
+    while (!g_quit && (g_controlOpen || g_runningTimers > 0))
+    {
+        int count = epoll_wait(g_epollFd, events, MAX_EVENTS, -1);
+        if (count < 0)
+        {
+            if (errno == EINTR) continue;
+            std::perror("epoll_wait");
+            return;
+        }
+
+        for (int i = 0; i < count; ++i)
+        {
+            uint64_t tag = events[i].data.u64;
+            if (tag == SIGNAL_EVENT)       OnSignalEvent();
+            else if (tag == CONTROL_EVENT) OnControlInput();
+            else                           OnTimerEvent(static_cast<int>(tag));
+        }
+    }
+}
+
+
+//================================================================================================//
+// Event Handlers
+//================================================================================================//
+
+/**
+ * @brief Handles a timer's one-shot timerfd, which fires once the whole remaining time has elapsed.
+ */
+void OnTimerEvent(int id)
+{
+    auto it = g_timers.find(id);
+    if (it == g_timers.end()) return;
+    DaemonTimer& timer = it->second;
+
+    uint64_t expirations = 0;
+    if (read(timer.timerFd, &expirations, sizeof(expirations)) != sizeof(expirations)) return;
+
+    if (timer.countdown.Advance(timer.countdown.GetRemainingSeconds()))
+    {
+        FinishTimer(id, timer);
+    }
+}
+
+/**
+ * @brief Reaps finished commands and handles termination requests.
+ */
+void OnSignalEvent()
+{
+    signalfd_siginfo info;
+    while (read(g_signalFd, &info, sizeof(info)) == sizeof(info))
+    {
+        if (info.ssi_signo == SIGCHLD)
+        {
+            while (waitpid(-1, NULL, WNOHANG) > 0)
+            {
+            }
+        }
+        else
+        {
+            g_quit = true;
+        }
+    }
+}
+
+/**
+ * @brief Reads available control input and handles every complete line.
+ */
+void OnControlInput()
+{
+    char buffer[4096];
+    ssize_t len = read(STDIN_FILENO, buffer, sizeof(buffer));
+    if (len < 0)
+    {
+        if (errno == EAGAIN || errno == EINTR) return;
+        len = 0;
+    }
+
+    if (len == 0)
+    {
+        // End of input: a final line without a newline still counts.
+        if (!g_controlBuffer.empty()) HandleControlLine(g_controlBuffer);
+        g_controlBuffer.clear();
+        epoll_ctl(g_epollFd, EPOLL_CTL_DEL, STDIN_FILENO, NULL);
+        g_controlOpen = false;
+        return;
+    }
+
+    g_controlBuffer.append(buffer, static_cast<size_t>(len));
+
+    size_t start = 0;
+    size_t newline;
+    while ((newline = g_controlBuffer.find('\n', start)) != std::string::npos)
+    {
+        HandleControlLine(std::string_view(g_controlBuffer).substr(start, newline - start));
+        start = newline + 1;
+    }
+    g_controlBuffer.erase(0, start);
+}
+
+
+//================================================================================================//
+// Timer Management
+//================================================================================================//
+
+/**
+ * @brief Registers a new timer and starts it right away if -start was given.
+ */
+int AddTimer(const CommandLineOptions& options)
+{
+    int id = g_nextTimerId++;
+    DaemonTimer& timer = g_timers[id];
+    timer.options = options;
+    timer.countdown.SetDuration(options.hours, options.minutes, options.seconds);
+    PrintTimer(id, timer, "added");
+
+    if (options.startImmediately && timer.countdown.GetRemainingSeconds() > 0)
+    {
+        StartTimer(id, timer);
+    }
+    return id;
+}
+
+/**
+ * @brief Returns the time left, counting whole seconds elapsed since a running timer was armed.
+ */
+int GetRemainingSeconds(const DaemonTimer& timer)
+{
+    int remainingSeconds = timer.countdown.GetRemainingSeconds();
+    if (timer.countdown.GetState() != TimerState::RUNNING) return remainingSeconds;
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - timer.startedAt);
+    long long left = remainingSeconds - elapsed.count();
+    return (left > 0) ? static_cast<int>(left) : 0;
+}
+
+/**
+ * @brief Starts or resumes a timer. A stopped timer restarts from its configured duration.
+ */
+void StartTimer(int id, DaemonTimer& timer)
+{
+    if (timer.countdown.GetState() == TimerState::RUNNING) return;
+
+    bool wasStopped = (timer.countdown.GetState() == TimerState::STOPPED);
+    if (wasStopped)
+    {
+        timer.countdown.SetDuration(timer.options.hours, timer.options.minutes, timer.options.seconds);
+    }
+
+    if (!timer.countdown.Start())
+    {
+        std::fprintf(stderr, "[%d] Please enter a time greater than 0 seconds.\n", id);
+        return;
+    }
+
+    // If the clock cannot be armed, put the timer back into the state it started from.
+    auto undoStart = [&](const char* what) {
+        std::perror(what);
+        DisarmTimer(timer);
+        if (wasStopped)
+        {
+            // Back to STOPPED with the configured duration, as shown by "added"
+            timer.countdown.Reset();
+            timer.countdown.SetDuration(timer.options.hours, timer.options.minutes, timer.options.seconds);
+        }
+        else
+        {
+            timer.countdown.Pause();
+        }
+    };
+
+    timer.timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (timer.timerFd < 0)
+    {
+        undoStart("timerfd_create");
+        return;
+    }
+    g_runningTimers++;
+
+    // A single one-shot expiry per run; the remaining time is computed on demand.
+    timer.startedAt = std::chrono::steady_clock::now();
+    itimerspec spec{};
+    spec.it_value.tv_sec = timer.countdown.GetRemainingSeconds();
+    if (timerfd_settime(timer.timerFd, 0, &spec, NULL) < 0)
+    {
+        undoStart("timerfd_settime");
+        return;
+    }
+
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.u64 = static_cast<uint64_t>(id);
+    if (epoll_ctl(g_epollFd, EPOLL_CTL_ADD, timer.timerFd, &ev) < 0)
+    {
+        undoStart("epoll_ctl");
+        return;
+    }
+
+    PrintTimer(id, timer, "started");
+}
+
+/**
+ * @brief Pauses a running timer, keeping the whole seconds that have elapsed so far.
+ */
+void PauseTimer(int id, DaemonTimer& timer)
+{
+    if (timer.countdown.GetState() != TimerState::RUNNING) return;
+
+    int elapsedSeconds = timer.countdown.GetRemainingSeconds() - GetRemainingSeconds(timer);
+    if (timer.countdown.Advance(elapsedSeconds))
+    {
+        // The timerfd is due at this very moment
+        FinishTimer(id, timer);
+        return;
+    }
+
+    timer.countdown.Pause();
+    DisarmTimer(timer);
+    PrintTimer(id, timer, "paused");
+}
+
+void ResetTimer(int id, DaemonTimer& timer)
+{
+    DisarmTimer(timer);
+    timer.countdown.Reset();
+    PrintTimer(id, timer, "reset");
+}
+
+/**
+ * @brief Stops a timer whose countdown has expired and runs its command.
+ */
+void FinishTimer(int id, DaemonTimer& timer)
+{
+    DisarmTimer(timer);
+    PrintTimer(id, timer, "finished");
+    ExecuteTimerCommand(id, timer);
+}
+
+/**
+ * @brief Closes the timerfd, which also removes it from the epoll set.
+ */
+void DisarmTimer(DaemonTimer& timer)
+{
+    if (timer.timerFd >= 0)
+    {
+        close(timer.timerFd);
+        timer.timerFd = -1;
+        g_runningTimers--;
+    }
+}
+
+/**
+ * @brief Executes the timer's command once its countdown has finished.
+ */
+void ExecuteTimerCommand(int id, const DaemonTimer& timer)
+{
+    if (timer.options.command.empty()) return;
+
+    if (unsigned long err = LaunchCommand(timer.options.command); err != 0)
+    {
+        std::fprintf(stderr, "[%d] Failed to execute command (Error code: %lu)\n", id, err);
+    }
+}
+
+void ListTimers()
+{
+    for (const auto& [id, timer] : g_timers)
+    {
+        const char* state = "stopped";
+        if (timer.countdown.GetState() == TimerState::RUNNING) state = "running";
+        else if (timer.countdown.GetState() == TimerState::PAUSED) state = "paused";
+        PrintTimer(id, timer, state);
+    }
+}
+
+
+//================================================================================================//
+// Control Input
+//================================================================================================//
+
+/**
+ * @brief Handles one control line; see ParseControlLine for the accepted forms.
+ */
+void HandleControlLine(std::string_view line)
+{
+    ControlCommand command = ParseControlLine(line);
+
+    switch (command.verb)
+    {
+    case ControlVerb::NONE:      return;
+    case ControlVerb::ADD_TIMER: AddTimer(command.options); return;
+    case ControlVerb::LIST:      ListTimers(); return;
+    case ControlVerb::QUIT:      g_quit = true; return;
+    case ControlVerb::INVALID_ARGS:
+        std::fprintf(stderr, "Invalid Argument Error: Check your arguments.\n");
+        return;
+    default:
+        break;
+    }
+
+    auto it = g_timers.find(command.timerId);
+    if (command.verb == ControlVerb::UNKNOWN || it == g_timers.end())
+    {
+        std::fprintf(stderr, "Unknown command or timer: %.*s\n", static_cast<int>(line.size()), line.data());
+        return;
+    }
+
+    switch (command.verb)
+    {
+    case ControlVerb::START: StartTimer(it->first, it->second); break;
+    case ControlVerb::PAUSE: PauseTimer(it->first, it->second); break;
+    case ControlVerb::RESET: ResetTimer(it->first, it->second); break;
+    case ControlVerb::REMOVE:
+        DisarmTimer(it->second);
+        PrintTimer(it->first, it->second, "removed");
+        g_timers.erase(it);
+        break;
+    default:
+        break;
+    }
+}
+
+
+//================================================================================================//
+// Utility
+//================================================================================================//
+
+void PrintTimer(int id, const DaemonTimer& timer, const char* event)
+{
+    int remainingSeconds = GetRemainingSeconds(timer);
+    int h = remainingSeconds / 3600;
+    int m = (remainingSeconds % 3600) / 60;
+    int s = remainingSeconds % 60;
+    std::printf("[%d] %s %02d:%02d:%02d %s\n", id, event, h, m, s, timer.options.command.c_str());
+}
+
+void PrintUsage()
+{
+    std::fprintf(stderr,
+        "Invalid Argument Error: Check your arguments.\n"
+        "Supports the arguments -start -h -m -s -cmd.\n"
+        "-cmd must be the last argument.\n"
+        "Example: commandtimerd -start -m 30 -cmd \"systemctl suspend\"\n"
+        "\n"
+        "Further timers are read from standard input, one per line, using the same arguments.\n"
+        "Control lines: start <id> | pause <id> | reset <id> | remove <id> | list | quit\n");
+}
@@ -0,0 +1,106 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "ControlLine.h"
+
+
+//================================================================================================//
+// Test Helpers
+//================================================================================================//
+
+int g_failures = 0;
+
+// Unlike assert(), keeps checking in release builds.
+#define CHECK(expr) \
+    do { \
+        if (!(expr)) { \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #expr); \
+            ++g_failures; \
+        } \
+    } while (0)
+
+using Tokens = std::vector<std::string>;
+
+
+//================================================================================================//
+// SplitControlLine
+//================================================================================================//
+
+void TestSplitControlLine()
+{
+    CHECK(SplitControlLine("").empty());
+    CHECK(SplitControlLine(" \t ").empty());
+    CHECK((SplitControlLine("start  1") == Tokens{ "start", "1" }));
+    CHECK((SplitControlLine("\tlist\t") == Tokens{ "list" }));
+
+    // Double quotes group words and are removed
+    CHECK((SplitControlLine("-cmd \"echo hello\"") == Tokens{ "-cmd", "echo hello" }));
+    CHECK((SplitControlLine("-cmd a\"b c\"d") == Tokens{ "-cmd", "ab cd" }));
+    CHECK((SplitControlLine("-cmd \"unterminated quote") == Tokens{ "-cmd", "unterminated quote" }));
+
+    // An empty quoted string is still a token
+    CHECK((SplitControlLine("-cmd \"\"") == Tokens{ "-cmd", "" }));
+    CHECK((SplitControlLine("\"\" x") == Tokens{ "", "x" }));
+
+    // CR from CRLF input separates like whitespace, except inside quotes
+    CHECK((SplitControlLine("list\r") == Tokens{ "list" }));
+    CHECK((SplitControlLine("pause 2\r") == Tokens{ "pause", "2" }));
+    CHECK((SplitControlLine("-cmd \"a\rb\"") == Tokens{ "-cmd", "a\rb" }));
+}
+
+
+//================================================================================================//
+// ParseControlLine
+//================================================================================================//
+
+void TestParseControlLine()
+{
+    CHECK(ParseControlLine("").verb == ControlVerb::NONE);
+    CHECK(ParseControlLine("   \r").verb == ControlVerb::NONE);
+
+    // '-' lines use the command-line arguments
+    ControlCommand command = ParseControlLine("-start -m 5 -cmd echo \"two words\"\r");
+    CHECK(command.verb == ControlVerb::ADD_TIMER);
+    CHECK(command.options.startImmediately);
+    CHECK(command.options.minutes == 5);
+    CHECK(command.options.command == "echo two words");
+
+    CHECK(ParseControlLine("-m").verb == ControlVerb::INVALID_ARGS);
+    CHECK(ParseControlLine("-x 1").verb == ControlVerb::INVALID_ARGS);
+    CHECK(ParseControlLine("-s 99999999999").verb == ControlVerb::INVALID_ARGS);
+
+    // Timer verbs need exactly one numeric id
+    command = ParseControlLine("start 3");
+    CHECK(command.verb == ControlVerb::START && command.timerId == 3);
+    command = ParseControlLine("pause 1\r");
+    CHECK(command.verb == ControlVerb::PAUSE && command.timerId == 1);
+    command = ParseControlLine("reset 12");
+    CHECK(command.verb == ControlVerb::RESET && command.timerId == 12);
+    command = ParseControlLine("remove 7");
+    CHECK(command.verb == ControlVerb::REMOVE && command.timerId == 7);
+
+    CHECK(ParseControlLine("start").verb == ControlVerb::UNKNOWN);
+    CHECK(ParseControlLine("start x").verb == ControlVerb::UNKNOWN);
+    CHECK(ParseControlLine("start 1 2").verb == ControlVerb::UNKNOWN);
+    CHECK(ParseControlLine("stop 1").verb == ControlVerb::UNKNOWN);
+    CHECK(ParseControlLine("bogus").verb == ControlVerb::UNKNOWN);
+
+    CHECK(ParseControlLine("list").verb == ControlVerb::LIST);
+    CHECK(ParseControlLine("quit\r").verb == ControlVerb::QUIT);
+}
+
+
+int main()
+{
+    TestSplitControlLine();
+    TestParseControlLine();
+
+    if (g_failures != 0)
+    {
+        std::fprintf(stderr, "%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    std::printf("All control line tests passed\n");
+    return 0;
+}
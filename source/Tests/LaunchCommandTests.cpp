@@ -0,0 +1,100 @@
+#include <windows.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "CommandLauncher.h"
+
+
+//================================================================================================//
+// Test Helpers
+//================================================================================================//
+
+int g_failures = 0;
+
+// Unlike assert(), keeps checking in release builds.
+#define CHECK(expr) \
+    do { \
+        if (!(expr)) { \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #expr); \
+            ++g_failures; \
+        } \
+    } while (0)
+
+/**
+ * @brief Waits up to timeoutMs for path to contain at least lines lines.
+ */
+bool WaitForLines(const std::wstring& path, int lines, DWORD timeoutMs)
+{
+    DWORD start = GetTickCount();
+    do
+    {
+        std::wifstream file(path);
+        int count = 0;
+        for (std::wstring line; std::getline(file, line);) ++count;
+        if (count >= lines) return true;
+        Sleep(50);
+    } while (GetTickCount() - start < timeoutMs);
+    return false;
+}
+
+
+//================================================================================================//
+// LaunchCommand
+//================================================================================================//
+
+/**
+ * @brief A batch file with arguments is started through cmd.exe. Cached launches must keep
+ * running the batch file instead of replaying cmd.exe without /c.
+ */
+void TestBatchFileWithArguments()
+{
+    wchar_t tempDir[MAX_PATH];
+    GetTempPathW(MAX_PATH, tempDir);
+    std::wstring batchPath = std::wstring(tempDir) + L"CommandTimerTest.bat";
+    std::wstring markerPath = std::wstring(tempDir) + L"CommandTimerTest.txt";
+    DeleteFileW(markerPath.c_str());
+
+    {
+        std::wofstream batch(batchPath);
+        batch << L"@echo %1>>\"" << markerPath << L"\"\r\n";
+    }
+
+    ClearLaunchSpecCache();
+    std::wstring cmd = L"\"" + batchPath + L"\" nightly";
+    for (int i = 1; i <= 3; ++i)
+    {
+        CHECK(LaunchCommand(cmd) == 0);
+        CHECK(WaitForLines(markerPath, i, 10000));
+    }
+
+    DeleteFileW(batchPath.c_str());
+    DeleteFileW(markerPath.c_str());
+}
+
+/**
+ * @brief An executable with arguments keeps launching once its spec is cached.
+ */
+void TestExecutableWithArguments()
+{
+    ClearLaunchSpecCache();
+    for (int i = 0; i < 3; ++i)
+    {
+        CHECK(LaunchCommand(L"cmd.exe /c exit 0") == 0);
+    }
+}
+
+
+int main()
+{
+    TestBatchFileWithArguments();
+    TestExecutableWithArguments();
+
+    if (g_failures != 0)
+    {
+        std::fprintf(stderr, "%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    std::printf("All LaunchCommand tests passed\n");
+    return 0;
+}
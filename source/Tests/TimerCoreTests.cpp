@@ -0,0 +1,196 @@
+#include <cstdio>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "CountdownTimer.h"
+#include "TimerArgs.h"
+#include "CommandHistory.h"
+
+
+//================================================================================================//
+// Test Helpers
+//================================================================================================//
+
+int g_failures = 0;
+
+// Unlike assert(), keeps checking in release builds.
+#define CHECK(expr) \
+    do { \
+        if (!(expr)) { \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #expr); \
+            ++g_failures; \
+        } \
+    } while (0)
+
+template <typename CharT, size_t N>
+std::optional<BasicCommandLineOptions<CharT>> Parse(const CharT* const (&argv)[N])
+{
+    return ParseTimerArgs<CharT>(static_cast<int>(N), argv);
+}
+
+
+//================================================================================================//
+// ParseTimerArgs
+//================================================================================================//
+
+void TestParseTimerArgs()
+{
+    // No arguments yields the defaults
+    const char* none[] = { "commandtimer" };
+    auto options = Parse(none);
+    CHECK(options.has_value());
+    CHECK(!options->startImmediately && options->hours == 0 && options->minutes == 0 && options->seconds == 0);
+    CHECK(options->command.empty());
+
+    // All options; -cmd joins words up to the next argument starting with '-'
+    const char* full[] = { "commandtimer", "-start", "-h", "1", "-m", "2", "-s", "3", "-cmd", "shutdown", "/s" };
+    options = Parse(full);
+    CHECK(options.has_value());
+    CHECK(options->startImmediately);
+    CHECK(options->hours == 1 && options->minutes == 2 && options->seconds == 3);
+    CHECK(options->command == "shutdown /s");
+
+    const char* stopAtDash[] = { "commandtimer", "-cmd", "notepad.exe", "a.txt", "-m", "5" };
+    options = Parse(stopAtDash);
+    CHECK(options.has_value());
+    CHECK(options->command == "notepad.exe a.txt");
+    CHECK(options->minutes == 5);
+
+    // Wide characters, as used by the Win32 front end
+    const wchar_t* wide[] = { L"commandtimer", L"-s", L"30", L"-cmd", L"calc.exe" };
+    auto wideOptions = Parse(wide);
+    CHECK(wideOptions.has_value());
+    CHECK(wideOptions->seconds == 30 && wideOptions->command == L"calc.exe");
+
+    // Missing values
+    const char* missingValue[] = { "commandtimer", "-m" };
+    CHECK(!Parse(missingValue).has_value());
+    const char* missingCommand[] = { "commandtimer", "-s", "5", "-cmd" };
+    CHECK(!Parse(missingCommand).has_value());
+
+    // Invalid and overflowing numbers
+    const char* negative[] = { "commandtimer", "-m", "-5" };
+    CHECK(!Parse(negative).has_value());
+    const char* notNumber[] = { "commandtimer", "-h", "1x" };
+    CHECK(!Parse(notNumber).has_value());
+    const char* overflow[] = { "commandtimer", "-s", "2147483648" };
+    CHECK(!Parse(overflow).has_value());
+    const char* intMax[] = { "commandtimer", "-s", "2147483647" };
+    options = Parse(intMax);
+    CHECK(options.has_value() && options->seconds == (std::numeric_limits<int>::max)());
+
+    // Unknown option
+    const char* unknown[] = { "commandtimer", "-x" };
+    CHECK(!Parse(unknown).has_value());
+}
+
+
+//================================================================================================//
+// CountdownTimer
+//================================================================================================//
+
+void TestCountdownTimer()
+{
+    CountdownTimer timer;
+    CHECK(timer.GetState() == TimerState::STOPPED);
+    CHECK(!timer.Start());      // nothing to count down
+    CHECK(!timer.Tick());
+
+    timer.SetDuration(0, 0, 3);
+    CHECK(timer.GetRemainingSeconds() == 3);
+    CHECK(!timer.Pause());      // not running yet
+    CHECK(timer.Start());
+    CHECK(timer.GetState() == TimerState::RUNNING);
+
+    CHECK(!timer.Tick());
+    CHECK(timer.GetRemainingSeconds() == 2);
+
+    // Ticks are ignored while paused
+    CHECK(timer.Pause());
+    CHECK(timer.GetState() == TimerState::PAUSED);
+    CHECK(!timer.Tick());
+    CHECK(timer.GetRemainingSeconds() == 2);
+
+    CHECK(timer.Start());
+    CHECK(!timer.Tick());
+    CHECK(timer.Tick());        // expires exactly once
+    CHECK(timer.GetState() == TimerState::STOPPED);
+    CHECK(timer.GetRemainingSeconds() == 0);
+    CHECK(!timer.Tick());
+
+    // Advance skips several seconds at once and expires exactly once
+    timer.SetDuration(0, 1, 0);
+    CHECK(timer.Start());
+    CHECK(!timer.Advance(0));
+    CHECK(!timer.Advance(45));
+    CHECK(timer.GetRemainingSeconds() == 15);
+    CHECK(timer.Pause());
+    CHECK(!timer.Advance(15));  // ignored while paused
+    CHECK(timer.Start());
+    CHECK(timer.Advance(100));  // overshooting stops at zero
+    CHECK(timer.GetRemainingSeconds() == 0);
+    CHECK(timer.GetState() == TimerState::STOPPED);
+    CHECK(!timer.Advance(1));
+
+    timer.SetDuration(1, 2, 3);
+    CHECK(timer.GetRemainingSeconds() == 3723);
+    CHECK(timer.Start());
+    timer.Reset();
+    CHECK(timer.GetState() == TimerState::STOPPED);
+    CHECK(timer.GetRemainingSeconds() == 0);
+
+    // SetDuration clamps instead of overflowing
+    constexpr int INT_MAX_VAL = (std::numeric_limits<int>::max)();
+    timer.SetDuration(INT_MAX_VAL, INT_MAX_VAL, INT_MAX_VAL);
+    CHECK(timer.GetRemainingSeconds() == INT_MAX_VAL);
+    timer.SetDuration(0, 0, -5);
+    CHECK(timer.GetRemainingSeconds() == 0);
+}
+
+
+//================================================================================================//
+// MergeCommandHistory
+//================================================================================================//
+
+void TestMergeCommandHistory()
+{
+    using History = std::vector<std::string>;
+
+    // Current command first, duplicates and empty entries dropped
+    History saved = { "calc.exe", "", "notepad.exe", "calc.exe", "mspaint.exe" };
+    History merged = MergeCommandHistory(std::string_view("notepad.exe"), saved);
+    CHECK((merged == History{ "notepad.exe", "calc.exe", "mspaint.exe" }));
+
+    // An empty current command is not added
+    merged = MergeCommandHistory(std::string_view(""), saved);
+    CHECK((merged == History{ "calc.exe", "notepad.exe", "mspaint.exe" }));
+
+    // Limited to MAX_HISTORY entries
+    History many;
+    for (int i = 0; i < MAX_HISTORY * 2; ++i)
+    {
+        many.push_back("cmd" + std::to_string(i));
+    }
+    merged = MergeCommandHistory(std::string_view("first"), many);
+    CHECK(merged.size() == static_cast<size_t>(MAX_HISTORY));
+    CHECK(merged.front() == "first");
+    CHECK(merged.back() == "cmd" + std::to_string(MAX_HISTORY - 2));
+}
+
+
+int main()
+{
+    TestParseTimerArgs();
+    TestCountdownTimer();
+    TestMergeCommandHistory();
+
+    if (g_failures != 0)
+    {
+        std::fprintf(stderr, "%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    std::printf("All TimerCore tests passed\n");
+    return 0;
+}
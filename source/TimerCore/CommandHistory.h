@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+
+
+//================================================================================================//
+// Command History
+//================================================================================================//
+
+constexpr int MAX_HISTORY = 20;
+
+/**
+ * @brief Builds the new history list: the current command first, then the saved commands
+ * without duplicates or empty entries, limited to MAX_HISTORY items.
+ */
+template <typename CharT>
+std::vector<std::basic_string<CharT>> MergeCommandHistory(
+    std::basic_string_view<CharT> currentCmd,
+    const std::vector<std::basic_string<CharT>>& savedHistory)
+{
+    std::vector<std::basic_string<CharT>> history;
+
+    if (!currentCmd.empty())
+    {
+        history.emplace_back(currentCmd);
+    }
+
+    for (const auto& cmd : savedHistory)
+    {
+        if (history.size() >= MAX_HISTORY) break;
+
+        if (!cmd.empty() && std::find(history.begin(), history.end(), cmd) == history.end())
+        {
+            history.push_back(cmd);
+        }
+    }
+
+    return history;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string>
+
+
+//================================================================================================//
+// Command Launcher
+//================================================================================================//
+
+// --- Native String Type ---
+#ifdef _WIN32
+using NativeChar = wchar_t;
+#else
+using NativeChar = char;
+#endif
+using NativeString = std::basic_string<NativeChar>;
+
+/**
+ * @brief Starts cmd without waiting for it to finish.
+ * Returns 0 on success, otherwise the platform error code (GetLastError / errno).
+ * ownerWindow is the HWND used for shell UI on Windows and is ignored elsewhere.
+ */
+unsigned long LaunchCommand(const NativeString& cmd, void* ownerWindow = nullptr);
+
+#ifdef _WIN32
+/**
+ * @brief Forgets every cached launch spec so the next launch resolves the command from scratch.
+ */
+void ClearLaunchSpecCache();
+#endif
@@ -0,0 +1,39 @@
+#include "CommandLauncher.h"
+
+#include <spawn.h>
+#include <signal.h>
+
+extern char** environ;
+
+
+/**
+ * @brief Runs cmd through /bin/sh so PATH lookup, quoting and redirections behave as in a shell.
+ * The child gets an empty signal mask and default handlers even if the caller blocked signals
+ * for signalfd. The caller is responsible for reaping the child (e.g. on SIGCHLD).
+ */
+unsigned long LaunchCommand(const NativeString& cmd, void* /*ownerWindow*/)
+{
+    posix_spawnattr_t attr;
+    if (int err = posix_spawnattr_init(&attr); err != 0) return err;
+
+    sigset_t emptyMask;
+    sigemptyset(&emptyMask);
+    sigset_t defaultSignals;
+    sigemptyset(&defaultSignals);
+    sigaddset(&defaultSignals, SIGCHLD);
+    sigaddset(&defaultSignals, SIGINT);
+    sigaddset(&defaultSignals, SIGTERM);
+    sigaddset(&defaultSignals, SIGHUP);
+    sigaddset(&defaultSignals, SIGPIPE);
+
+    posix_spawnattr_setsigmask(&attr, &emptyMask);
+    posix_spawnattr_setsigdefault(&attr, &defaultSignals);
+    posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF);
+
+    const char* argv[] = { "sh", "-c", cmd.c_str(), nullptr };
+    pid_t pid = 0;
+    int err = posix_spawn(&pid, "/bin/sh", nullptr, &attr, const_cast<char* const*>(argv), environ);
+
+    posix_spawnattr_destroy(&attr);
+    return static_cast<unsigned long>(err);
+}
@@ -0,0 +1,198 @@
+#include "CommandLauncher.h"
+
+#include <windows.h>
+#include <shellapi.h>
+#include <vector>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+
+//================================================================================================//
+// Launch Spec Cache
+//================================================================================================//
+
+// Commands that ShellExecute could not open are remembered here so that later launches
+// go straight to CreateProcess, passing the image that started last time when it is the
+// command's own program.
+struct LaunchSpec {
+    std::vector<wchar_t> commandLine;   // NUL-terminated buffer handed to CreateProcess
+    std::wstring executablePath;    // started image if it is argv[0]'s program, otherwise empty
+    FILETIME executableWriteTime{};
+    std::wstring pathEnvironment;   // PATH at the time the spec was compiled
+};
+
+static std::unordered_map<std::wstring, LaunchSpec> g_launchSpecCache;
+
+// Commands whose recorded image could not be started directly. Their specs never record an
+// image again, so a failing image does not cost an extra CreateProcess on every launch.
+static std::unordered_set<std::wstring> g_imageLaunchFailures;
+
+
+static std::wstring GetPathEnvironment() {
+    DWORD len = GetEnvironmentVariableW(L"PATH", NULL, 0);
+    if (len == 0) return std::wstring();
+
+    std::wstring path(len, L'\0');
+    len = GetEnvironmentVariableW(L"PATH", path.data(), len);
+    path.resize(len);
+    return path;
+}
+
+static std::optional<FILETIME> GetFileWriteTime(const std::wstring& path) {
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &data)) return std::nullopt;
+    return data.ftLastWriteTime;
+}
+
+static std::wstring_view GetFileNamePart(std::wstring_view path) {
+    size_t pos = path.find_last_of(L"\\/");
+    return (pos == std::wstring_view::npos) ? path : path.substr(pos + 1);
+}
+
+static bool EqualsIgnoreCase(std::wstring_view a, std::wstring_view b) {
+    return CompareStringOrdinal(a.data(), (int)a.size(), b.data(), (int)b.size(), TRUE) == CSTR_EQUAL;
+}
+
+static bool HasExtension(std::wstring_view name, std::wstring_view ext) {
+    return name.size() > ext.size() && EqualsIgnoreCase(name.substr(name.size() - ext.size()), ext);
+}
+
+/**
+ * @brief Checks that imagePath is the program named by cmd's first token and not a host such as
+ * cmd.exe, which CreateProcess starts for batch files and which cannot be replayed without /c.
+ */
+static bool IsImageOfFirstToken(const std::wstring& cmd, const std::wstring& imagePath)
+{
+    int argc = 0;
+    LPWSTR* argv = CommandLineToArgvW(cmd.c_str(), &argc);
+    if (argv == NULL) return false;
+
+    bool matches = false;
+    if (argc > 0)
+    {
+        std::wstring_view token = GetFileNamePart(argv[0]);
+        std::wstring_view image = GetFileNamePart(imagePath);
+
+        if (!HasExtension(token, L".bat") && !HasExtension(token, L".cmd"))
+        {
+            matches = EqualsIgnoreCase(token, image) ||
+                (!HasExtension(token, L".exe") && EqualsIgnoreCase(std::wstring(token) + L".exe", image));
+        }
+    }
+
+    LocalFree(argv);
+    return matches;
+}
+
+/**
+ * @brief Starts commandLine with CreateProcess. Returns 0 on success, otherwise the error code.
+ * If imagePath is given it receives the full path of the image that was started.
+ */
+static DWORD LaunchWithCreateProcess(const wchar_t* applicationName, std::vector<wchar_t> commandLine,
+    std::wstring* imagePath = nullptr)
+{
+    STARTUPINFOW si{ sizeof(si) };
+    PROCESS_INFORMATION pi{};
+
+    if (!CreateProcessW(applicationName, commandLine.data(), NULL, NULL, FALSE, 0, NULL, NULL, &si, &pi))
+    {
+        return GetLastError();
+    }
+
+    if (imagePath)
+    {
+        wchar_t image[MAX_PATH];
+        DWORD size = MAX_PATH;
+        if (QueryFullProcessImageNameW(pi.hProcess, 0, image, &size))
+        {
+            imagePath->assign(image, size);
+        }
+    }
+
+    CloseHandle(pi.hProcess);
+    CloseHandle(pi.hThread);
+    return 0;
+}
+
+/**
+ * @brief Builds the spec for cmd from the image CreateProcess actually started for it.
+ * The image is only kept when it is the command's own program; otherwise the spec just
+ * records that ShellExecute can be skipped.
+ */
+static LaunchSpec CompileLaunchSpec(const std::wstring& cmd, const std::wstring& imagePath)
+{
+    LaunchSpec spec;
+    spec.commandLine.assign(cmd.c_str(), cmd.c_str() + cmd.size() + 1);
+    spec.pathEnvironment = GetPathEnvironment();
+
+    if (imagePath.empty() || !IsImageOfFirstToken(cmd, imagePath)) return spec;
+
+    if (auto writeTime = GetFileWriteTime(imagePath); writeTime.has_value())
+    {
+        spec.executablePath = imagePath;
+        spec.executableWriteTime = writeTime.value();
+    }
+    return spec;
+}
+
+/**
+ * @brief Checks that neither PATH nor the recorded executable changed since the spec was compiled.
+ */
+static bool IsLaunchSpecCurrent(const LaunchSpec& spec)
+{
+    if (spec.pathEnvironment != GetPathEnvironment()) return false;
+    if (spec.executablePath.empty()) return true;
+
+    auto writeTime = GetFileWriteTime(spec.executablePath);
+    return writeTime.has_value() && CompareFileTime(&writeTime.value(), &spec.executableWriteTime) == 0;
+}
+
+
+//================================================================================================//
+// Command Launcher
+//================================================================================================//
+
+/**
+ * @brief Opens cmd with ShellExecute, falling back to CreateProcess for command lines
+ * with arguments that the shell cannot open directly.
+ */
+unsigned long LaunchCommand(const NativeString& cmd, void* ownerWindow)
+{
+    HWND hWnd = static_cast<HWND>(ownerWindow);
+
+    // Skip the ShellExecute attempt for commands already known to need CreateProcess
+    if (auto it = g_launchSpecCache.find(cmd); it != g_launchSpecCache.end())
+    {
+        const LaunchSpec& spec = it->second;
+        if (IsLaunchSpecCurrent(spec))
+        {
+            const wchar_t* appName = spec.executablePath.empty() ? NULL : spec.executablePath.c_str();
+            if (LaunchWithCreateProcess(appName, spec.commandLine) == 0) return 0;
+            if (appName != NULL) g_imageLaunchFailures.insert(cmd);
+        }
+        g_launchSpecCache.erase(it);
+    }
+
+    // Try executing with ShellExecute first
+    HINSTANCE hInst = ShellExecuteW(hWnd, L"open", cmd.c_str(), NULL, NULL, SW_SHOWNORMAL);
+    if ((INT_PTR)hInst <= 32)
+    {
+        // If ShellExecute fails, fallback to CreateProcess
+        std::vector<wchar_t> commandLine(cmd.c_str(), cmd.c_str() + cmd.size() + 1);
+        std::wstring imagePath;
+        DWORD err = LaunchWithCreateProcess(NULL, commandLine, &imagePath);
+        if (err != 0) return err;
+
+        if (g_imageLaunchFailures.contains(cmd)) imagePath.clear();
+        g_launchSpecCache[cmd] = CompileLaunchSpec(cmd, imagePath);
+    }
+    return 0;
+}
+
+void ClearLaunchSpecCache()
+{
+    g_launchSpecCache.clear();
+    g_imageLaunchFailures.clear();
+}
@@ -0,0 +1,75 @@
+#include "CountdownTimer.h"
+
+#include <algorithm>
+#include <limits>
+
+
+/**
+ * @brief Sets the remaining time. Values too large for an int are clamped.
+ */
+void CountdownTimer::SetDuration(int hours, int minutes, int seconds)
+{
+    long long total = (hours * 3600LL) + (minutes * 60LL) + seconds;
+    constexpr long long INT_MAX_VAL = (std::numeric_limits<int>::max)();
+    m_remainingSeconds = static_cast<int>((std::clamp)(total, 0LL, INT_MAX_VAL));
+}
+
+/**
+ * @brief Starts or resumes the countdown. Returns false if there is no time left to count down.
+ */
+bool CountdownTimer::Start()
+{
+    if (m_remainingSeconds <= 0) return false;
+
+    m_state = TimerState::RUNNING;
+    return true;
+}
+
+/**
+ * @brief Pauses a running countdown. Returns false if the timer was not running.
+ */
+bool CountdownTimer::Pause()
+{
+    if (m_state != TimerState::RUNNING) return false;
+
+    m_state = TimerState::PAUSED;
+    return true;
+}
+
+/**
+ * @brief Stops the countdown and clears the remaining time.
+ */
+void CountdownTimer::Reset()
+{
+    m_remainingSeconds = 0;
+    m_state = TimerState::STOPPED;
+}
+
+/**
+ * @brief Advances a running countdown by one second. Returns true when the countdown has just expired.
+ */
+bool CountdownTimer::Tick()
+{
+    return Advance(1);
+}
+
+/**
+ * @brief Advances a running countdown by the given number of seconds.
+ * Returns true when the countdown has just expired.
+ */
+bool CountdownTimer::Advance(int seconds)
+{
+    if (m_state != TimerState::RUNNING) return false;
+
+    if (seconds > 0)
+    {
+        m_remainingSeconds -= (std::min)(seconds, m_remainingSeconds);
+    }
+
+    if (m_remainingSeconds <= 0)
+    {
+        m_state = TimerState::STOPPED;
+        return true;
+    }
+    return false;
+}
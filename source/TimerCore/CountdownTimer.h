@@ -0,0 +1,37 @@
+#pragma once
+
+
+//================================================================================================//
+// Countdown Timer
+//================================================================================================//
+
+// --- Timer State ---
+enum class TimerState
+{
+    STOPPED,
+    RUNNING,
+    PAUSED
+};
+
+/**
+ * @brief Platform independent countdown driven by one Tick() per elapsed second, or by
+ * Advance() for front ends that measure several seconds at once.
+ * The front end owns the actual clock (SetTimer, timerfd, ...) and only forwards elapsed time.
+ */
+class CountdownTimer
+{
+public:
+    void SetDuration(int hours, int minutes, int seconds);
+    bool Start();
+    bool Pause();
+    void Reset();
+    bool Tick();
+    bool Advance(int seconds);
+
+    TimerState GetState() const { return m_state; }
+    int GetRemainingSeconds() const { return m_remainingSeconds; }
+
+private:
+    int        m_remainingSeconds = 0;
+    TimerState m_state = TimerState::STOPPED;
+};
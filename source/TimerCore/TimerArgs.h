@@ -0,0 +1,95 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <optional>
+#include <limits>
+
+
+//================================================================================================//
+// Command Line Arguments
+//================================================================================================//
+
+// --- CommandLine Options ---
+// Templated on the character type so the Win32 front end can use wchar_t and POSIX front ends char.
+template <typename CharT>
+struct BasicCommandLineOptions {
+    bool startImmediately = false;
+    int hours = 0;
+    int minutes = 0;
+    int seconds = 0;
+    std::basic_string<CharT> command = std::basic_string<CharT>();
+};
+
+/**
+ * @brief Parses a non-negative decimal integer, rejecting anything else including overflow.
+ */
+template <typename CharT>
+std::optional<int> ValidateAndParsePositiveInt(std::basic_string_view<CharT> s) {
+    if (s.empty()) return std::nullopt;
+
+    int value = 0;
+    constexpr int INT_MAX_VAL = (std::numeric_limits<int>::max)();
+
+    for (CharT ch : s) {
+        if (ch < CharT('0') || ch > CharT('9')) return std::nullopt;
+        int digit = ch - CharT('0');
+        if (value > (INT_MAX_VAL - digit) / 10) return std::nullopt;
+        value = value * 10 + digit;
+    }
+    return value;
+}
+
+/**
+ * @brief Compares an argument against an ASCII option name such as "-start".
+ */
+template <typename CharT>
+bool IsTimerArg(std::basic_string_view<CharT> arg, std::string_view name) {
+    if (arg.size() != name.size()) return false;
+
+    for (size_t i = 0; i < name.size(); ++i) {
+        if (arg[i] != static_cast<CharT>(name[i])) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Parses the -start -h -m -s -cmd arguments. argv[0] is the program name and is skipped.
+ * -cmd consumes every following argument up to the next one starting with '-'.
+ */
+template <typename CharT>
+std::optional<BasicCommandLineOptions<CharT>> ParseTimerArgs(int argc, const CharT* const* argv) {
+    BasicCommandLineOptions<CharT> options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::basic_string_view<CharT> arg = argv[i];
+
+        if (IsTimerArg(arg, "-start")) {
+            options.startImmediately = true;
+        }
+        else if (IsTimerArg(arg, "-h") || IsTimerArg(arg, "-m") || IsTimerArg(arg, "-s")) {
+            if (i + 1 >= argc) return std::nullopt;
+
+            auto value = ValidateAndParsePositiveInt(std::basic_string_view<CharT>(argv[++i]));
+            if (!value.has_value()) return std::nullopt;
+
+            if (IsTimerArg(arg, "-h")) options.hours = value.value();
+            else if (IsTimerArg(arg, "-m")) options.minutes = value.value();
+            else if (IsTimerArg(arg, "-s")) options.seconds = value.value();
+        }
+        else if (IsTimerArg(arg, "-cmd")) {
+            if (i + 1 >= argc) return std::nullopt;
+
+            options.command = argv[++i];
+            while (i + 1 < argc && argv[i + 1][0] != CharT('-')) {
+                options.command += CharT(' ');
+                options.command += argv[++i];
+            }
+        }
+        else {
+            return std::nullopt;
+        }
+    }
+
+    return options;
+}